@@ -1,7 +1,18 @@
 #ifndef Z_AKR_ENUMERATOR_HH
 #define Z_AKR_ENUMERATOR_HH
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace akr
 {
@@ -194,71 +205,1307 @@ namespace akr
         }
 
         public:
-        constexpr auto begin ()       noexcept ->       ReverseIterator&
+        constexpr auto begin ()       noexcept ->       ReverseIterator&
+        {
+            return reverseBegin;
+        }
+        constexpr auto end   ()       noexcept ->       ReverseIterator&
+        {
+            return reverseEnd;
+        }
+
+        constexpr auto begin () const noexcept -> const ReverseIterator&
+        {
+            return reverseBegin;
+        }
+        constexpr auto end   () const noexcept -> const ReverseIterator&
+        {
+            return reverseEnd;
+        }
+
+        constexpr auto cbegin() const noexcept -> const ReverseIterator&
+        {
+            return reverseBegin;
+        }
+        constexpr auto cend  () const noexcept -> const ReverseIterator&
+        {
+            return reverseEnd;
+        }
+
+        private:
+        template<class T>
+        static consteval auto isIncOperatorNoexcept() noexcept -> bool
+        {
+            if constexpr (!std::is_class_v<T>)
+            {
+                return true;
+            }
+            else
+            {
+                return noexcept(std::declval<T>().operator++());
+            }
+        }
+
+        template<class T>
+        static consteval auto isDecOperatorNoexcept() noexcept -> bool
+        {
+            if constexpr (!std::is_class_v<T>)
+            {
+                return true;
+            }
+            else
+            {
+                return noexcept(std::declval<T>().operator--());
+            }
+        }
+    };
+
+    template<class T, std::size_t N>
+    explicit ReverseEnumerator(T(&array_)[N]) -> ReverseEnumerator<T*>;
+
+    template<class T>
+    explicit ReverseEnumerator(T&& container) -> ReverseEnumerator<decltype(container.begin())>;
+
+    template<class Iterator, class Compare = std::less<>>
+    struct MergeEnumerator final
+    {
+        private:
+        template<class Range>
+        static consteval auto isRange() noexcept -> bool
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Range>, MergeEnumerator>)
+            {
+                return false;
+            }
+            else
+            {
+                return requires (Range& range) { std::begin(range); std::end(range); };
+            }
+        }
+
+        private:
+        struct MergeRun final
+        {
+            Iterator iterator;
+
+            Iterator end;
+
+            bool     exhausted;
+        };
+
+        struct MergeSentinel final
+        {
+        };
+
+        struct MergeIterator final
+        {
+            public:
+            using value_type      = std::remove_cvref_t<decltype(*std::declval<const Iterator&>())>;
+
+            using difference_type = std::ptrdiff_t;
+
+            private:
+            MergeEnumerator* enumerator;
+
+            public:
+            explicit constexpr MergeIterator(MergeEnumerator* enumerator_) noexcept:
+                enumerator { enumerator_ }
+            {
+            }
+
+            public:
+            constexpr auto operator* () const noexcept(noexcept(*std::declval<const Iterator&>())) -> auto&&
+            {
+                return *enumerator->winner().iterator;
+            }
+
+            constexpr auto operator->() const noexcept -> const Iterator&
+            {
+                return  enumerator->winner().iterator;
+            }
+
+            constexpr auto operator++(   ) -> MergeIterator&
+            {
+                auto&& rhs = *this;
+
+                rhs.enumerator->advance();
+
+                return rhs;
+            }
+            constexpr auto operator++(int) -> void
+            {
+                ++*this;
+            }
+
+            constexpr auto operator==(MergeSentinel) const noexcept -> bool
+            {
+                return enumerator->exhausted();
+            }
+        };
+
+        private:
+        std::vector<MergeRun>    mergeRuns;
+
+        std::vector<std::size_t> mergeTree;
+
+        [[no_unique_address]]
+        Compare                  mergeCompare;
+
+        public:
+        template<class... Ranges> requires (isRange<Ranges>() && ...)
+        explicit constexpr MergeEnumerator(Ranges&&... ranges):
+            MergeEnumerator(Compare(), ranges...)
+        {
+        }
+
+        template<class... Ranges> requires (isRange<Ranges>() && ...)
+        explicit constexpr MergeEnumerator(Compare compare, Ranges&&... ranges):
+            mergeCompare { compare }
+        {
+            mergeRuns.reserve(sizeof...(Ranges));
+
+            (append(ranges), ...);
+
+            build();
+        }
+
+        template<std::input_iterator RangeIterator>
+        explicit constexpr MergeEnumerator(RangeIterator first, RangeIterator last):
+            MergeEnumerator(Compare(), first, last)
+        {
+        }
+
+        template<std::input_iterator RangeIterator>
+        explicit constexpr MergeEnumerator(Compare compare, RangeIterator first, RangeIterator last):
+            mergeCompare { compare }
+        {
+            for (; first != last; ++first)
+            {
+                append(*first);
+            }
+
+            build();
+        }
+
+        public:
+        constexpr auto begin()       noexcept -> MergeIterator
+        {
+            return MergeIterator(this);
+        }
+        constexpr auto end  () const noexcept -> MergeSentinel
+        {
+            return MergeSentinel();
+        }
+
+        private:
+        template<class Range>
+        constexpr auto append(Range&& range) -> void
+        {
+            auto&& run = mergeRuns.emplace_back(MergeRun { std::begin(range), std::end(range), false });
+
+            run.exhausted = !(run.iterator != run.end);
+        }
+
+        constexpr auto build() -> void
+        {
+            const auto size = mergeRuns.size();
+
+            mergeTree.assign(size, 0);
+
+            if (size < 2)
+            {
+                return;
+            }
+
+            auto winners = std::vector<std::size_t>(size * 2);
+
+            for (auto leaf = size; leaf < size * 2; leaf++)
+            {
+                winners[leaf] = leaf - size;
+            }
+
+            for (auto node = size - 1; node > 0; node--)
+            {
+                const auto lhs  = winners[node * 2    ];
+                const auto rhs  = winners[node * 2 + 1];
+                const auto wins = beats(lhs, rhs);
+
+                winners  [node] = wins ? lhs : rhs;
+                mergeTree[node] = wins ? rhs : lhs;
+            }
+
+            mergeTree[0] = winners[1];
+        }
+
+        constexpr auto advance() -> void
+        {
+            auto&& run = winner();
+
+            ++run.iterator;
+
+            run.exhausted = !(run.iterator != run.end);
+
+            auto champion = mergeTree[0];
+
+            for (auto node = (champion + mergeRuns.size()) / 2; node > 0; node /= 2)
+            {
+                const auto loser = mergeTree[node];
+                const auto wins  = beats(loser, champion);
+
+                mergeTree[node] = wins ? champion : loser;
+                champion        = wins ? loser    : champion;
+            }
+
+            mergeTree[0] = champion;
+        }
+
+        constexpr auto beats(std::size_t lhs, std::size_t rhs) const -> bool
+        {
+            const auto& lhsRun = mergeRuns[lhs];
+            const auto& rhsRun = mergeRuns[rhs];
+
+            if (lhsRun.exhausted || rhsRun.exhausted)
+            {
+                return !lhsRun.exhausted || (rhsRun.exhausted && lhs < rhs);
+            }
+
+            return lhs < rhs ? !mergeCompare(*rhsRun.iterator, *lhsRun.iterator)
+                             :  mergeCompare(*lhsRun.iterator, *rhsRun.iterator);
+        }
+
+        constexpr auto winner()          noexcept -> MergeRun&
+        {
+            return mergeRuns[mergeTree[0]];
+        }
+
+        constexpr auto exhausted() const noexcept -> bool
+        {
+            return mergeRuns.empty() || mergeRuns[mergeTree[0]].exhausted;
+        }
+    };
+
+    template<class Range, class... Ranges>
+    explicit MergeEnumerator(Range&& range, Ranges&&... ranges)
+        -> MergeEnumerator<std::remove_cvref_t<decltype(std::begin(range))>>;
+
+    template<class Compare, class Range, class... Ranges> requires (!requires (Compare& compare) { std::begin(compare); })
+    explicit MergeEnumerator(Compare&& compare, Range&& range, Ranges&&... ranges)
+        -> MergeEnumerator<std::remove_cvref_t<decltype(std::begin(range))>, std::decay_t<Compare>>;
+
+    template<std::input_iterator RangeIterator>
+    explicit MergeEnumerator(RangeIterator first, RangeIterator last)
+        -> MergeEnumerator<std::remove_cvref_t<decltype(std::begin(*first))>>;
+
+    template<class Compare, std::input_iterator RangeIterator>
+    explicit MergeEnumerator(Compare compare, RangeIterator first, RangeIterator last)
+        -> MergeEnumerator<std::remove_cvref_t<decltype(std::begin(*first))>, Compare>;
+
+    struct GatherPrefetch final
+    {
+        auto operator()(const void* address) const noexcept -> void
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#else
+            static_cast<void>(address);
+#endif
+        }
+    };
+
+    template<class TableIterator, class IndexIterator, class Prefetch = GatherPrefetch>
+    struct GatherEnumerator final
+    {
+        private:
+        static constexpr std::size_t cacheLineSize   = 64;
+
+        static constexpr std::size_t streamStride    = cacheLineSize * 2;
+
+        static constexpr std::size_t streamThreshold = 4;
+
+        struct GatherIterator final
+        {
+            private:
+            TableIterator  table;
+
+            IndexIterator  iterator;
+
+            IndexIterator  lookahead;
+
+            IndexIterator  end;
+
+            bool           prefetching;
+
+            std::uintptr_t prefetchLine     = 0;
+
+            std::uintptr_t lookaheadAddress = 0;
+
+            std::intptr_t  lookaheadDelta   = 0;
+
+            std::size_t    streamLength     = 0;
+
+            [[no_unique_address]]
+            Prefetch       prefetch;
+
+            public:
+            explicit constexpr GatherIterator(TableIterator table_, IndexIterator begin_, IndexIterator end_,
+                                              std::size_t   distance, Prefetch prefetch_):
+                table       { table_        },
+                iterator    { begin_        },
+                lookahead   { begin_        },
+                end         { end_          },
+                prefetching { distance != 0 },
+                prefetch    { prefetch_     }
+            {
+                for (; distance != 0 && prefetching; distance--)
+                {
+                    prefetchNext();
+                }
+            }
+
+            public:
+            constexpr auto operator* () const noexcept(noexcept(std::declval<TableIterator>()[*std::declval<IndexIterator>()]))
+                -> auto&&
+            {
+                return table[*iterator];
+            }
+
+            constexpr auto operator->() const noexcept(noexcept(std::declval<TableIterator>()[*std::declval<IndexIterator>()]))
+            {
+                return std::addressof(table[*iterator]);
+            }
+
+            constexpr auto operator++(   ) -> GatherIterator&
+            {
+                auto&& rhs = *this;
+
+                ++rhs.iterator;
+
+                rhs.prefetchNext();
+
+                return rhs;
+            }
+            constexpr auto operator++(int) -> GatherIterator
+            {
+                auto&& lhs = *this;
+
+                GatherIterator tmp(lhs);
+
+                ++lhs;
+
+                return tmp;
+            }
+
+            friend constexpr auto operator!=(GatherIterator& lhs, const GatherIterator& rhs) -> bool
+            {
+                return lhs.iterator != rhs.iterator;
+            }
+
+            private:
+            constexpr auto prefetchNext() -> void
+            {
+                if (!prefetching || !(prefetching = lookahead != end))
+                {
+                    return;
+                }
+
+                if (!std::is_constant_evaluated())
+                {
+                    const auto address = std::addressof(table[*lookahead]);
+                    const auto current = reinterpret_cast<std::uintptr_t>(address);
+                    const auto delta   = std::intptr_t(current - lookaheadAddress);
+
+                    if (delta != 0)
+                    {
+                        const auto monotone = (delta > 0) == (lookaheadDelta > 0);
+                        const auto distance = std::uintptr_t(delta > 0 ? delta : -delta);
+
+                        streamLength     = monotone && distance <= streamStride ? streamLength + 1 : 0;
+                        lookaheadDelta   = delta;
+                        lookaheadAddress = current;
+
+                        if (streamLength < streamThreshold && current / cacheLineSize != prefetchLine)
+                        {
+                            prefetchLine = current / cacheLineSize;
+
+                            prefetch(address);
+                        }
+                    }
+                }
+
+                ++lookahead;
+            }
+        };
+
+        private:
+        GatherIterator gatherBegin;
+
+        GatherIterator gatherEnd;
+
+        public:
+        template<class Table, class Indices>
+        explicit constexpr GatherEnumerator(Table&& table, Indices&& indices, std::size_t distance = 16,
+                                            Prefetch prefetch = Prefetch()):
+            gatherBegin { std::begin(table), std::begin(indices), std::end(indices), distance, prefetch },
+            gatherEnd   { std::begin(table), std::end  (indices), std::end(indices), 0,        prefetch }
+        {
+        }
+
+        public:
+        constexpr auto begin ()       noexcept ->       GatherIterator&
+        {
+            return gatherBegin;
+        }
+        constexpr auto end   ()       noexcept ->       GatherIterator&
+        {
+            return gatherEnd;
+        }
+
+        constexpr auto begin () const noexcept -> const GatherIterator&
+        {
+            return gatherBegin;
+        }
+        constexpr auto end   () const noexcept -> const GatherIterator&
+        {
+            return gatherEnd;
+        }
+
+        constexpr auto cbegin() const noexcept -> const GatherIterator&
+        {
+            return gatherBegin;
+        }
+        constexpr auto cend  () const noexcept -> const GatherIterator&
+        {
+            return gatherEnd;
+        }
+    };
+
+    template<class Table, class Indices>
+    explicit GatherEnumerator(Table&& table, Indices&& indices)
+        -> GatherEnumerator<decltype(std::begin(table)), std::remove_cvref_t<decltype(std::begin(indices))>>;
+
+    template<class Table, class Indices>
+    explicit GatherEnumerator(Table&& table, Indices&& indices, std::size_t distance)
+        -> GatherEnumerator<decltype(std::begin(table)), std::remove_cvref_t<decltype(std::begin(indices))>>;
+
+    template<class Table, class Indices, class Prefetch>
+    explicit GatherEnumerator(Table&& table, Indices&& indices, std::size_t distance, Prefetch prefetch)
+        -> GatherEnumerator<decltype(std::begin(table)), std::remove_cvref_t<decltype(std::begin(indices))>, Prefetch>;
+
+    template<class T, std::size_t N>
+    struct StaticEnumerator final
+    {
+        private:
+        T* staticBegin;
+
+        public:
+        explicit constexpr StaticEnumerator(T(&array_)[N]) noexcept:
+            staticBegin { array_ }
+        {
+        }
+
+        explicit constexpr StaticEnumerator(std::array<std::remove_const_t<T>, N>& array_) noexcept:
+            staticBegin { array_.data() }
+        {
+        }
+
+        explicit constexpr StaticEnumerator(const std::array<std::remove_const_t<T>, N>& array_) noexcept
+            requires std::is_const_v<T>:
+            staticBegin { array_.data() }
+        {
+        }
+
+        public:
+        constexpr auto begin () const noexcept -> T*
+        {
+            return staticBegin;
+        }
+        constexpr auto end   () const noexcept -> T*
+        {
+            return staticBegin + N;
+        }
+
+        constexpr auto cbegin() const noexcept -> const T*
+        {
+            return staticBegin;
+        }
+        constexpr auto cend  () const noexcept -> const T*
+        {
+            return staticBegin + N;
+        }
+
+        static constexpr auto size() noexcept -> std::size_t
+        {
+            return N;
+        }
+
+        template<class Function>
+        constexpr auto forEach       (Function&& function) const noexcept(isInvokeNoexcept<Function>()) -> void
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                (invoke<I        >(function), ...);
+            }(std::make_index_sequence<N>());
+        }
+
+        template<class Function>
+        constexpr auto reverseForEach(Function&& function) const noexcept(isInvokeNoexcept<Function>()) -> void
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                (invoke<N - 1 - I>(function), ...);
+            }(std::make_index_sequence<N>());
+        }
+
+        private:
+        template<std::size_t I, class Function>
+        constexpr auto invoke(Function& function) const noexcept(isInvokeNoexcept<Function>()) -> void
+        {
+            if constexpr (std::is_invocable_v<Function&, T&, std::integral_constant<std::size_t, I>>)
+            {
+                function(staticBegin[I], std::integral_constant<std::size_t, I>());
+            }
+            else
+            {
+                function(staticBegin[I]);
+            }
+        }
+
+        template<class Function>
+        static consteval auto isInvokeNoexcept() noexcept -> bool
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                return (isInvokeNoexcept<Function, I>() && ...);
+            }(std::make_index_sequence<N>());
+        }
+
+        template<class Function, std::size_t I>
+        static consteval auto isInvokeNoexcept() noexcept -> bool
+        {
+            if constexpr (std::is_invocable_v<Function&, T&, std::integral_constant<std::size_t, I>>)
+            {
+                return std::is_nothrow_invocable_v<Function&, T&, std::integral_constant<std::size_t, I>>;
+            }
+            else
+            {
+                return std::is_nothrow_invocable_v<Function&, T&>;
+            }
+        }
+    };
+
+    template<class T, std::size_t N>
+    explicit StaticEnumerator(T(&array_)[N]) -> StaticEnumerator<T, N>;
+
+    template<class T, std::size_t N>
+    explicit StaticEnumerator(std::array<T, N>& array_) -> StaticEnumerator<T, N>;
+
+    template<class T, std::size_t N>
+    explicit StaticEnumerator(const std::array<T, N>& array_) -> StaticEnumerator<const T, N>;
+
+    template<class Iterator>
+    struct BufferedReverseEnumerator final
+    {
+        private:
+        static constexpr bool checkpointed = std::forward_iterator<Iterator>;
+
+        using Buffered = std::conditional_t<checkpointed, Iterator, std::iter_value_t<Iterator>>;
+
+        struct BufferedIterator final
+        {
+            public:
+            using value_type      = std::remove_cvref_t<decltype(*std::declval<const Iterator&>())>;
+
+            using difference_type = std::ptrdiff_t;
+
+            private:
+            BufferedReverseEnumerator* enumerator;
+
+            std::vector<Iterator>      window;
+
+            std::size_t                block     = 0;
+
+            std::size_t                position  = 0;
+
+            std::size_t                remaining = 0;
+
+            public:
+            explicit constexpr BufferedIterator(BufferedReverseEnumerator* enumerator_, std::size_t remaining_):
+                enumerator { enumerator_ },
+                remaining  { remaining_  }
+            {
+                if (remaining == 0)
+                {
+                    return;
+                }
+
+                if constexpr (checkpointed)
+                {
+                    block = enumerator->checkpoints.size();
+
+                    load(--block);
+                }
+                else
+                {
+                    position = enumerator->buffer.size();
+                }
+            }
+
+            public:
+            constexpr auto operator* () const noexcept(!checkpointed || noexcept(*std::declval<const Iterator&>()))
+                -> auto&&
+            {
+                if constexpr (checkpointed)
+                {
+                    return *window[position - 1];
+                }
+                else
+                {
+                    return enumerator->buffer[position - 1];
+                }
+            }
+
+            constexpr auto operator++(   ) -> BufferedIterator&
+            {
+                auto&& rhs = *this;
+
+                --rhs.remaining;
+                --rhs.position;
+
+                if constexpr (checkpointed)
+                {
+                    if (rhs.position == 0 && rhs.block != 0)
+                    {
+                        rhs.load(--rhs.block);
+                    }
+                }
+
+                return rhs;
+            }
+            constexpr auto operator++(int) -> BufferedIterator
+            {
+                auto&& lhs = *this;
+
+                BufferedIterator tmp(lhs);
+
+                ++lhs;
+
+                return tmp;
+            }
+
+            constexpr auto operator==(const BufferedIterator& rhs) const noexcept -> bool
+            {
+                return remaining == rhs.remaining;
+            }
+
+            private:
+            constexpr auto load(std::size_t block_) -> void
+            {
+                auto iterator = enumerator->checkpoints[block_];
+                auto length   = block_ + 1 == enumerator->checkpoints.size()
+                              ? enumerator->count - block_ * enumerator->stride : enumerator->stride;
+
+                window.clear();
+                window.reserve(enumerator->stride);
+
+                for (; length != 0; length--, ++iterator)
+                {
+                    window.push_back(iterator);
+                }
+
+                position = window.size();
+            }
+        };
+
+        private:
+        std::vector<Iterator> checkpoints;
+
+        std::vector<Buffered> buffer;
+
+        std::size_t           stride = 1;
+
+        std::size_t           count  = 0;
+
+        public:
+        template<class T, std::size_t N>
+        explicit constexpr BufferedReverseEnumerator(T(&array_)[N]):
+            BufferedReverseEnumerator(array_, array_ + N)
+        {
+        }
+
+        template<class T>
+        explicit constexpr BufferedReverseEnumerator(T&& container):
+            BufferedReverseEnumerator(container.begin(), container.end())
+        {
+        }
+
+        template<class Sentinel>
+        explicit constexpr BufferedReverseEnumerator(Iterator begin, Sentinel end)
+        {
+            if constexpr (checkpointed)
+            {
+                for (; begin != end; ++begin, count++)
+                {
+                    if (count % stride != 0)
+                    {
+                        continue;
+                    }
+
+                    checkpoints.push_back(begin);
+
+                    if (checkpoints.size() > stride * 2)
+                    {
+                        for (std::size_t i = 0; i * 2 < checkpoints.size(); i++)
+                        {
+                            checkpoints[i] = checkpoints[i * 2];
+                        }
+
+                        checkpoints.erase(checkpoints.begin() + (checkpoints.size() + 1) / 2, checkpoints.end());
+
+                        stride *= 2;
+                    }
+                }
+            }
+            else
+            {
+                for (; begin != end; ++begin, count++)
+                {
+                    buffer.push_back(*begin);
+                }
+            }
+        }
+
+        public:
+        constexpr auto begin() -> BufferedIterator
+        {
+            return BufferedIterator(this, count);
+        }
+        constexpr auto end  () -> BufferedIterator
+        {
+            return BufferedIterator(this, 0);
+        }
+
+        constexpr auto size () const noexcept -> std::size_t
+        {
+            return count;
+        }
+    };
+
+    template<class T, std::size_t N>
+    explicit BufferedReverseEnumerator(T(&array_)[N]) -> BufferedReverseEnumerator<T*>;
+
+    template<class T>
+    explicit BufferedReverseEnumerator(T&& container)
+        -> BufferedReverseEnumerator<std::remove_cvref_t<decltype(container.begin())>>;
+
+    template<class Iterator, class Predicate = std::equal_to<>>
+    struct RunEnumerator final
+    {
+        private:
+        using Value = std::remove_cvref_t<decltype(*std::declval<Iterator&>())>;
+
+        template<class T>
+        static consteval auto isReverseIterator() noexcept -> bool
+        {
+            if constexpr (requires { typename T::iterator_type; })
+            {
+                return std::is_same_v<T, std::reverse_iterator<typename T::iterator_type>>;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        static consteval auto isVectorizable() noexcept -> bool
+        {
+            if constexpr ((!std::is_integral_v<Value> || std::is_same_v<Value, bool>)
+                       && !std::is_same_v<Value, float> && !std::is_same_v<Value, double>)
+            {
+                return false;
+            }
+            else
+            {
+                return std::is_same_v<Predicate, std::equal_to<>> || std::is_same_v<Predicate, std::equal_to<Value>>;
+            }
+        }
+
+        static consteval auto isForwardVectorizable() noexcept -> bool
+        {
+            if constexpr (!isVectorizable())
+            {
+                return false;
+            }
+            else
+            {
+                return std::contiguous_iterator<Iterator>;
+            }
+        }
+
+        static consteval auto isReverseVectorizable() noexcept -> bool
+        {
+            if constexpr (!isVectorizable() || !isReverseIterator<Iterator>())
+            {
+                return false;
+            }
+            else
+            {
+                return std::contiguous_iterator<typename Iterator::iterator_type>;
+            }
+        }
+
+        private:
+        struct Run final
+        {
+            decltype(*std::declval<Iterator&>()) value;
+
+            ForwardEnumerator<Iterator>          range;
+
+            std::size_t                          count;
+        };
+
+        struct RunIterator final
+        {
+            private:
+            Iterator    first;
+
+            Iterator    next;
+
+            Iterator    last;
+
+            std::size_t count = 0;
+
+            [[no_unique_address]]
+            Predicate   predicate;
+
+            public:
+            explicit constexpr RunIterator(Iterator begin_, Iterator end_, Predicate predicate_):
+                first     { begin_     },
+                next      { begin_     },
+                last      { end_       },
+                predicate { predicate_ }
+            {
+                scan();
+            }
+
+            public:
+            constexpr auto operator* () const -> Run
+            {
+                return Run { *first, ForwardEnumerator<Iterator>(first, next), count };
+            }
+
+            constexpr auto operator++(   ) -> RunIterator&
+            {
+                auto&& rhs = *this;
+
+                rhs.first = rhs.next;
+
+                rhs.scan();
+
+                return rhs;
+            }
+            constexpr auto operator++(int) -> RunIterator
+            {
+                auto&& lhs = *this;
+
+                RunIterator tmp(lhs);
+
+                ++lhs;
+
+                return tmp;
+            }
+
+            friend constexpr auto operator!=(const RunIterator& lhs, const RunIterator& rhs) -> bool
+            {
+                return lhs.first != rhs.first;
+            }
+
+            private:
+            constexpr auto scan() -> void
+            {
+                if (first == last)
+                {
+                    count = 0;
+
+                    return;
+                }
+
+                if constexpr (isForwardVectorizable())
+                {
+                    const auto head = std::to_address(first);
+
+                    count = std::size_t(mismatch(head + 1, std::to_address(last), *head) - head);
+                    next  = first + std::ptrdiff_t(count);
+                }
+                else if constexpr (isReverseVectorizable())
+                {
+                    const auto head = std::to_address(first.base()) - 1;
+
+                    count = std::size_t(head + 1 - reverseMismatch(std::to_address(last.base()), head, *head));
+                    next  = first + std::ptrdiff_t(count);
+                }
+                else
+                {
+                    auto previous = first;
+
+                    next  = first;
+                    count = 0;
+
+                    do
+                    {
+                        previous = next;
+
+                        ++next;
+                        ++count;
+                    }
+                    while (next != last && predicate(*previous, *next));
+                }
+            }
+        };
+
+        private:
+        RunIterator runBegin;
+
+        RunIterator runEnd;
+
+        public:
+        template<class T, std::size_t N>
+        explicit constexpr RunEnumerator(T(&array_)[N], Predicate predicate = Predicate()):
+            RunEnumerator(array_, array_ + N, predicate)
+        {
+        }
+
+        template<class T>
+        explicit constexpr RunEnumerator(T&& container, Predicate predicate = Predicate()):
+            RunEnumerator(container.begin(), container.end(), predicate)
+        {
+        }
+
+        template<class ForwardIterator>
+        explicit constexpr RunEnumerator(ReverseEnumerator<ForwardIterator> reverse, Predicate predicate = Predicate()):
+            RunEnumerator(Iterator(std::next(reverse.begin().operator->())), Iterator(reverse.end().operator->()), predicate)
+        {
+        }
+
+        explicit constexpr RunEnumerator(Iterator begin, Iterator end, Predicate predicate = Predicate()):
+            runBegin { begin, end, predicate },
+            runEnd   { end,   end, predicate }
+        {
+        }
+
+        public:
+        constexpr auto begin ()       noexcept ->       RunIterator&
+        {
+            return runBegin;
+        }
+        constexpr auto end   ()       noexcept ->       RunIterator&
+        {
+            return runEnd;
+        }
+
+        constexpr auto begin () const noexcept -> const RunIterator&
+        {
+            return runBegin;
+        }
+        constexpr auto end   () const noexcept -> const RunIterator&
+        {
+            return runEnd;
+        }
+
+        constexpr auto cbegin() const noexcept -> const RunIterator&
+        {
+            return runBegin;
+        }
+        constexpr auto cend  () const noexcept -> const RunIterator&
+        {
+            return runEnd;
+        }
+
+        private:
+        static constexpr auto mismatch(const Value* first, const Value* last, Value value) noexcept -> const Value*
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if (!std::is_constant_evaluated())
+            {
+                typedef Value         Lanes __attribute__((vector_size(16)));
+                typedef std::uint64_t Words __attribute__((vector_size(16)));
+
+                constexpr auto lanes = sizeof(Lanes) / sizeof(Value) * 4;
+
+                for (; std::size_t(last - first) >= lanes; first += lanes)
+                {
+                    Lanes block[4];
+
+                    std::memcpy(block, first, sizeof(block));
+
+                    const auto words = reinterpret_cast<Words>((block[0] != value) | (block[1] != value)
+                                                             | (block[2] != value) | (block[3] != value));
+
+                    if ((words[0] | words[1]) != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+#endif
+            for (; first != last && *first == value; ++first)
+            {
+            }
+
+            return first;
+        }
+
+        static constexpr auto reverseMismatch(const Value* first, const Value* last, Value value) noexcept -> const Value*
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if (!std::is_constant_evaluated())
+            {
+                typedef Value         Lanes __attribute__((vector_size(16)));
+                typedef std::uint64_t Words __attribute__((vector_size(16)));
+
+                constexpr auto lanes = sizeof(Lanes) / sizeof(Value) * 4;
+
+                for (; std::size_t(last - first) >= lanes; last -= lanes)
+                {
+                    Lanes block[4];
+
+                    std::memcpy(block, last - lanes, sizeof(block));
+
+                    const auto words = reinterpret_cast<Words>((block[0] != value) | (block[1] != value)
+                                                             | (block[2] != value) | (block[3] != value));
+
+                    if ((words[0] | words[1]) != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+#endif
+            for (; first != last && *(last - 1) == value; --last)
+            {
+            }
+
+            return last;
+        }
+    };
+
+    template<class T, std::size_t N>
+    explicit RunEnumerator(T(&array_)[N]) -> RunEnumerator<T*>;
+
+    template<class T, std::size_t N, class Predicate>
+    explicit RunEnumerator(T(&array_)[N], Predicate predicate) -> RunEnumerator<T*, Predicate>;
+
+    template<class T>
+    explicit RunEnumerator(T&& container) -> RunEnumerator<std::remove_cvref_t<decltype(container.begin())>>;
+
+    template<class T, class Predicate>
+    explicit RunEnumerator(T&& container, Predicate predicate)
+        -> RunEnumerator<std::remove_cvref_t<decltype(container.begin())>, Predicate>;
+
+    template<class ForwardIterator>
+    explicit RunEnumerator(ReverseEnumerator<ForwardIterator> reverse)
+        -> RunEnumerator<std::reverse_iterator<ForwardIterator>>;
+
+    template<class ForwardIterator, class Predicate>
+    explicit RunEnumerator(ReverseEnumerator<ForwardIterator> reverse, Predicate predicate)
+        -> RunEnumerator<std::reverse_iterator<ForwardIterator>, Predicate>;
+
+    template<class T, std::size_t Capacity = 8 * sizeof(void*)>
+    struct AnyEnumerator final
+    {
+        private:
+        template<class Enumerator>
+        struct Model final
+        {
+            Enumerator                                      source;
+
+            decltype(std::declval<Enumerator&>().begin())  current;
+
+            decltype(std::declval<Enumerator&>().end  ())  last;
+
+            template<class U>
+            using Source = std::conditional_t<std::is_lvalue_reference_v<U>, const Enumerator&, Enumerator&&>;
+
+            template<class U>
+            explicit constexpr Model(U&& source_)
+                noexcept(std::is_nothrow_constructible_v<Enumerator, Source<U>>
+                         && noexcept(decltype(current)(std::declval<Enumerator&>().begin()))
+                         && noexcept(decltype(last   )(std::declval<Enumerator&>().end  ()))):
+                source  { static_cast<Source<U>>(source_) },
+                current { source.begin() },
+                last    { source.end  () }
+            {
+            }
+        };
+
+        struct Dispatch final
+        {
+            auto (*read   )(void* model, std::span<T> buffer) -> std::span<const T>;
+
+            auto (*destroy)(void* model) noexcept -> void;
+        };
+
+        private:
+        alignas(std::max_align_t)
+        std::byte       anyStorage[Capacity];
+
+        const Dispatch* anyDispatch;
+
+        public:
+        AnyEnumerator() noexcept:
+            anyDispatch { &emptyDispatch }
         {
-            return reverseBegin;
         }
-        constexpr auto end   ()       noexcept ->       ReverseIterator&
+
+        template<class Enumerator> requires (!std::is_same_v<std::remove_cvref_t<Enumerator>, AnyEnumerator>)
+        explicit AnyEnumerator(Enumerator&& enumerator) noexcept(isNothrowConstructible<Enumerator>()):
+            anyDispatch { &modelDispatch<Model<std::remove_cvref_t<Enumerator>>> }
         {
-            return reverseEnd;
+            using M = Model<std::remove_cvref_t<Enumerator>>;
+
+            static_assert(!isContainer<std::remove_cvref_t<Enumerator>>(),
+                          "AnyEnumerator does not copy owning containers; wrap them as ForwardEnumerator(container)");
+            static_assert(std::is_trivially_destructible_v<std::remove_cvref_t<Enumerator>>,
+                          "AnyEnumerator never allocates; enumerators that own resources cannot be stored inline");
+            static_assert(sizeof (M) <= Capacity,                  "enumerator does not fit into AnyEnumerator storage");
+            static_assert(alignof(M) <= alignof(std::max_align_t), "enumerator is over-aligned for AnyEnumerator storage");
+
+            std::construct_at(reinterpret_cast<M*>(anyStorage), std::forward<Enumerator>(enumerator));
         }
 
-        constexpr auto begin () const noexcept -> const ReverseIterator&
+        AnyEnumerator(const AnyEnumerator&) = delete;
+
+        auto operator=(const AnyEnumerator&) -> AnyEnumerator& = delete;
+
+        ~AnyEnumerator()
         {
-            return reverseBegin;
+            anyDispatch->destroy(anyStorage);
         }
-        constexpr auto end   () const noexcept -> const ReverseIterator&
+
+        public:
+        auto read(std::span<T> buffer) -> std::span<const T>
         {
-            return reverseEnd;
+            return anyDispatch->read(anyStorage, buffer);
         }
 
-        constexpr auto cbegin() const noexcept -> const ReverseIterator&
+        template<class Function>
+        auto forEach(Function&& function) -> void
         {
-            return reverseBegin;
+            T buffer[64];
+
+            for (auto batch = read(buffer); !batch.empty(); batch = read(buffer))
+            {
+                for (auto&& e : batch)
+                {
+                    function(e);
+                }
+            }
         }
-        constexpr auto cend  () const noexcept -> const ReverseIterator&
+
+        private:
+        template<class M>
+        static auto readModel(void* model_, std::span<T> buffer) -> std::span<const T>
         {
-            return reverseEnd;
+            auto&& model = *std::launder(static_cast<M*>(model_));
+
+            using Iterator = std::remove_cvref_t<decltype(model.current)>;
+            using Sentinel = std::remove_cvref_t<decltype(model.last   )>;
+
+            if constexpr (isContiguous<Iterator, Sentinel>())
+            {
+                const auto batch = std::span<const T>(std::to_address(model.current), std::to_address(model.last));
+
+                model.current = model.last;
+
+                return batch;
+            }
+            else
+            {
+                std::size_t count = 0;
+
+                for (; count < buffer.size() && model.current != model.last; ++model.current)
+                {
+                    buffer[count++] = *model.current;
+                }
+
+                return buffer.first(count);
+            }
         }
 
-        private:
-        template<class T>
-        static consteval auto isIncOperatorNoexcept() noexcept -> bool
+        template<class Enumerator>
+        static consteval auto isContainer() noexcept -> bool
         {
-            if constexpr (!std::is_class_v<T>)
+            if constexpr (std::is_array_v<Enumerator> || requires { typename Enumerator::allocator_type; })
             {
                 return true;
             }
+            else if constexpr (requires { typename Enumerator::value_type; std::tuple_size<Enumerator>::value; })
+            {
+                return std::is_same_v<Enumerator, std::array<typename Enumerator::value_type,
+                                                             std::tuple_size<Enumerator>::value>>;
+            }
             else
             {
-                return noexcept(std::declval<T>().operator++());
+                return false;
             }
         }
 
-        template<class T>
-        static consteval auto isDecOperatorNoexcept() noexcept -> bool
+        template<class Enumerator>
+        static consteval auto isNothrowConstructible() noexcept -> bool
         {
-            if constexpr (!std::is_class_v<T>)
+            if constexpr (isContainer<std::remove_cvref_t<Enumerator>>())
             {
-                return true;
+                return false;
             }
             else
             {
-                return noexcept(std::declval<T>().operator--());
+                return std::is_nothrow_constructible_v<Model<std::remove_cvref_t<Enumerator>>, Enumerator&&>;
             }
         }
-    };
 
-    template<class T, std::size_t N>
-    explicit ReverseEnumerator(T(&array_)[N]) -> ReverseEnumerator<T*>;
+        template<class Iterator, class Sentinel>
+        static consteval auto isContiguous() noexcept -> bool
+        {
+            if constexpr (!std::contiguous_iterator<Iterator> || !std::is_same_v<Iterator, Sentinel>)
+            {
+                return false;
+            }
+            else
+            {
+                return std::is_same_v<std::iter_value_t<Iterator>, T>;
+            }
+        }
 
-    template<class T>
-    explicit ReverseEnumerator(T&& container) -> ReverseEnumerator<decltype(container.begin())>;
+        template<class M>
+        static auto destroyModel(void* model_) noexcept -> void
+        {
+            std::destroy_at(std::launder(static_cast<M*>(model_)));
+        }
+
+        static auto readEmpty(void*, std::span<T>) noexcept -> std::span<const T>
+        {
+            return std::span<const T>();
+        }
+
+        static auto destroyEmpty(void*) noexcept -> void
+        {
+        }
+
+        template<class M>
+        static constexpr Dispatch modelDispatch { &readModel<M>, &destroyModel<M> };
+
+        static constexpr Dispatch emptyDispatch { &readEmpty,    &destroyEmpty    };
+    };
+
+    template<class Enumerator>
+    explicit AnyEnumerator(Enumerator&& enumerator)
+        -> AnyEnumerator<std::remove_cvref_t<decltype(*std::declval<Enumerator&>().begin())>>;
 }
 
 #ifdef  D_AKR_TEST
-#include <vector>
+#include <algorithm>
+#include <forward_list>
 #include <list>
+#include <sstream>
 #include <string>
 
 namespace akr::test
@@ -726,6 +1973,542 @@ namespace akr::test
         rbegin->clear();
         assert(rbegin->empty());
     });
+
+    AKR_TEST(MergeEnumerator,
+    {
+        const auto collect = [](auto&& merge_)
+        {
+            auto out_ = std::vector<int>();
+            for (auto&& e_ : merge_)
+            {
+                out_.push_back(e_);
+            }
+            return out_;
+        };
+
+        auto vec1 = std::vector({ 1, 4, 7 });
+        auto vec2 = std::vector({ 2, 5, 8, 9 });
+        auto vec3 = std::vector({ 0, 3, 6 });
+
+        assert(collect(MergeEnumerator(vec1, vec2, vec3)) == std::vector({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+        assert(collect(MergeEnumerator(vec2)) == vec2);
+        assert(collect(MergeEnumerator(vec2, std::vector<int>(), vec3)) == std::vector({ 0, 2, 3, 5, 6, 8, 9 }));
+        assert(collect(MergeEnumerator(ForwardEnumerator(vec2.begin(), vec2.begin() + 2),
+                                       ForwardEnumerator(vec2.begin() + 2, vec2.end()))) == vec2);
+
+        auto lst1 = std::list({ 1, 4, 7 });
+        auto lst2 = std::list({ 0, 3, 6 });
+
+        assert(collect(MergeEnumerator(lst1, lst2)) == std::vector({ 0, 1, 3, 4, 6, 7 }));
+        assert(collect(MergeEnumerator(std::greater<>(), ReverseEnumerator(lst1), ReverseEnumerator(lst2)))
+               == std::vector({ 7, 6, 4, 3, 1, 0 }));
+        assert(collect(MergeEnumerator(std::greater<>(), ReverseEnumerator(vec1), ReverseEnumerator(vec2)))
+               == std::vector({ 9, 8, 7, 5, 4, 2, 1 }));
+
+        const auto byTens = [](int lhs_, int rhs_) { return lhs_ / 10 < rhs_ / 10; };
+        assert(collect(MergeEnumerator(byTens, std::vector({ 10, 21, 30 }), std::vector({ 11, 20, 31 })))
+               == std::vector({ 10, 11, 21, 20, 30, 31 }));
+
+        auto runs = std::vector<std::vector<int>>();
+        for (auto i = 0; i < 7; i++)
+        {
+            runs.emplace_back();
+            for (auto j = i; j < 40; j += 1 + i)
+            {
+                runs.back().push_back(j);
+            }
+        }
+
+        auto expected = std::vector<int>();
+        for (auto&& run_ : runs)
+        {
+            expected.insert(expected.end(), run_.begin(), run_.end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        assert(collect(MergeEnumerator(runs.begin(), runs.end())) == expected);
+        assert(collect(MergeEnumerator(runs.begin(), runs.begin())).empty());
+
+        std::reverse(expected.begin(), expected.end());
+        for (auto&& run_ : runs)
+        {
+            std::reverse(run_.begin(), run_.end());
+        }
+        assert(collect(MergeEnumerator(std::greater<>(), runs.begin(), runs.end())) == expected);
+
+        static_assert(std::input_iterator<decltype(MergeEnumerator(vec1, vec3).begin())>);
+        static_assert(std::input_iterator<decltype(MergeEnumerator(std::greater<>(), ReverseEnumerator(vec1)).begin())>);
+
+        auto merge = MergeEnumerator(vec1, vec3);
+        auto iter  = merge.begin();
+        *iter += 100;
+        assert(vec3.front() == 100);
+        ++iter;
+        assert(*iter == 1 && iter != merge.end());
+        iter++;
+        assert(*iter == 3);
+    });
+
+    AKR_TEST(GatherEnumerator,
+    {
+        const auto collect = [](auto&& gather_)
+        {
+            auto out_ = std::vector<int>();
+            for (auto&& e_ : gather_)
+            {
+                out_.push_back(e_);
+            }
+            return out_;
+        };
+
+        int a[8];
+        for (auto i = 0; i < 8; i++) a[i] = i * 10;
+
+        auto table   = std::vector({ 0, 10, 20, 30, 40, 50, 60, 70 });
+        auto indices = std::vector({ 3, 0, 7, 7, 2 });
+
+        assert(collect(GatherEnumerator(a,     indices)) == std::vector({ 30, 0, 70, 70, 20 }));
+        assert(collect(GatherEnumerator(table, indices)) == std::vector({ 30, 0, 70, 70, 20 }));
+        assert(collect(GatherEnumerator(table, std::list({ 1, 6, 4 }))) == std::vector({ 10, 60, 40 }));
+        assert(collect(GatherEnumerator(table, ReverseEnumerator(indices))) == std::vector({ 20, 70, 70, 0, 30 }));
+        assert(collect(GatherEnumerator(table, ForwardEnumerator(indices.begin() + 1, indices.begin() + 3)))
+               == std::vector({ 0, 70 }));
+        assert(collect(GatherEnumerator(table, std::vector<int>())).empty());
+
+        for (auto distance = 0; distance < 10; distance++)
+        {
+            assert(collect(GatherEnumerator(table, indices, distance)) == std::vector({ 30, 0, 70, 70, 20 }));
+            assert(collect(GatherEnumerator(table, ReverseEnumerator(indices), distance))
+                   == std::vector({ 20, 70, 70, 0, 30 }));
+        }
+
+        auto big    = std::vector<int>(1 << 16);
+        auto sorted = std::vector<int>();
+        for (auto i = 0; i < (1 << 16); i++)
+        {
+            big[i] = i;
+            if (i % 3 != 0)
+            {
+                sorted.push_back(i);
+            }
+        }
+        assert(collect(GatherEnumerator(big, sorted)) == sorted);
+
+        auto prefetches = std::size_t(0);
+        const auto count = [&](const void*) { prefetches++; };
+
+        assert(collect(GatherEnumerator(big, sorted, 16, count)) == sorted);
+        assert(prefetches <= 4);
+
+        prefetches = 0;
+        assert(collect(GatherEnumerator(big, ReverseEnumerator(sorted), 16, count)).front() == sorted.back());
+        assert(prefetches <= 4);
+
+        auto scattered = std::vector<int>();
+        for (auto i = 0; i < (1 << 12); i++)
+        {
+            scattered.push_back(i * 7919 % (1 << 16));
+        }
+
+        prefetches = 0;
+        assert(collect(GatherEnumerator(big, scattered, 16, count)) == scattered);
+        assert(prefetches == scattered.size());
+
+        prefetches = 0;
+        assert(collect(GatherEnumerator(big, ReverseEnumerator(scattered), 16, count)).front() == scattered.back());
+        assert(prefetches == scattered.size());
+
+        prefetches = 0;
+        assert(collect(GatherEnumerator(big, scattered, 0, count)) == scattered);
+        assert(prefetches == 0);
+
+        for (auto&& e_ : GatherEnumerator(table, indices))
+        {
+            e_ += 1;
+        }
+        assert(table == std::vector({ 1, 10, 21, 31, 40, 50, 60, 72 }));
+
+        const auto ctable = table;
+        const auto cge    = GatherEnumerator(ctable, indices);
+        auto       iter   = cge.cbegin();
+        assert(*iter++ == 31);
+        assert(*iter   ==  1);
+        static_assert(std::is_same_v<decltype(*iter), const int&>);
+    });
+
+    AKR_TEST(StaticEnumerator,
+    {
+        int a[5];
+        for (auto i = 0; i < 5; i++) a[i] = i + 1;
+
+        static_assert(std::is_same_v<decltype(StaticEnumerator(a)), StaticEnumerator<int, 5>>);
+        static_assert(StaticEnumerator<int, 5>::size() == 5);
+        static_assert(noexcept(StaticEnumerator(a)));
+
+        auto se = StaticEnumerator(a);
+
+        auto i = 1;
+        for (auto&& e_ : se)
+        {
+            assert(e_ == i++);
+        }
+        assert(i == 6);
+
+        i = 1;
+        se.forEach([&](int& e_) { assert(e_ == i++); e_ += 10; });
+        assert(i == 6);
+
+        se.forEach([](int& e_, auto i_)
+        {
+            static_assert(decltype(i_)::value < 5);
+            assert(e_ == int(i_) + 11);
+            e_ -= 10;
+        });
+
+        i = 5;
+        se.reverseForEach([&](int& e_, auto i_) { assert(e_ == i-- && int(i_) == e_ - 1); });
+        assert(i == 0);
+
+        static_assert( noexcept(se.forEach([](int&) noexcept {})));
+        static_assert(!noexcept(se.forEach([](int&) {})));
+        static_assert( noexcept(se.reverseForEach([](int&, auto) noexcept {})));
+
+        auto arr = std::to_array({ 1, 2, 3, 4 });
+        static_assert(std::is_same_v<decltype(StaticEnumerator(arr)), StaticEnumerator<int, 4>>);
+
+        const auto carr = std::to_array({ 1, 2, 3, 4 });
+        static_assert(std::is_same_v<decltype(StaticEnumerator(carr)), StaticEnumerator<const int, 4>>);
+
+        auto sum = 0;
+        StaticEnumerator(carr).forEach([&](const int& e_) { sum += e_; });
+        assert(sum == 10);
+
+        StaticEnumerator(arr).reverseForEach([&](int& e_, auto i_) { e_ = int(i_) * sum; });
+        assert(arr == std::to_array({ 0, 10, 20, 30 }));
+
+        constexpr auto dot = []()
+        {
+            auto lhs_ = std::to_array({ 1, 2, 3 });
+            auto rhs_ = std::to_array({ 4, 5, 6 });
+            auto dot_ = 0;
+            StaticEnumerator(lhs_).forEach([&](int e_, auto i_) { dot_ += e_ * std::get<i_>(rhs_); });
+            return dot_;
+        }();
+        static_assert(dot == 32);
+
+        constexpr auto last = []()
+        {
+            int elems_[3];
+            auto last_ = 0;
+            StaticEnumerator(elems_).forEach       ([](int& e_, auto i_) { e_ = int(i_); });
+            StaticEnumerator(elems_).reverseForEach([&](int& e_) { last_ = last_ * 10 + e_; });
+            return last_;
+        }();
+        static_assert(last == 210);
+    });
+
+    AKR_TEST(BufferedReverseEnumerator,
+    {
+        const auto collect = [](auto&& buffered_)
+        {
+            auto out_ = std::vector<int>();
+            for (auto&& e_ : buffered_)
+            {
+                out_.push_back(e_);
+            }
+            return out_;
+        };
+
+        for (auto n = 0; n < 300; n++)
+        {
+            auto flist    = std::forward_list<int>();
+            auto expected = std::vector<int>();
+            for (auto i = 0; i < n; i++)
+            {
+                flist.push_front(i);
+                expected.push_back(n - 1 - i);
+            }
+            std::reverse(expected.begin(), expected.end());
+
+            auto bre_ = BufferedReverseEnumerator(flist);
+            assert(bre_.size() == std::size_t(n));
+            assert(collect(bre_) == expected);
+            assert(collect(bre_) == expected);
+        }
+
+        auto flist = std::forward_list({ 1, 2, 3, 4, 5 });
+
+        static_assert(std::is_same_v<decltype(BufferedReverseEnumerator(flist)),
+                                     BufferedReverseEnumerator<std::forward_list<int>::iterator>>);
+
+        auto i = 5;
+        for (auto&& e_ : BufferedReverseEnumerator(flist))
+        {
+            assert(e_ == i--);
+            e_ += 10;
+        }
+        assert(i == 0);
+        assert(flist == std::forward_list({ 11, 12, 13, 14, 15 }));
+
+        assert(collect(BufferedReverseEnumerator(ForwardEnumerator(std::next(flist.begin()), flist.end())))
+               == std::vector({ 15, 14, 13, 12 }));
+
+        int a[5];
+        for (auto k = 0; k < 5; k++) a[k] = k + 1;
+        assert(collect(BufferedReverseEnumerator(a)) == std::vector({ 5, 4, 3, 2, 1 }));
+
+        auto stream = std::istringstream("1 2 3 4 5");
+        auto input  = BufferedReverseEnumerator(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        assert(input.size() == 5);
+        assert(collect(input) == std::vector({ 5, 4, 3, 2, 1 }));
+        assert(collect(input) == std::vector({ 5, 4, 3, 2, 1 }));
+
+        auto vec1 = std::vector({ 1, 4, 7 });
+        auto vec2 = std::vector({ 2, 5, 8, 9 });
+        assert(collect(BufferedReverseEnumerator(MergeEnumerator(vec1, vec2)))
+               == std::vector({ 9, 8, 7, 5, 4, 2, 1 }));
+
+        auto history = std::forward_list({ 1, 1, 2, 3, 3, 3 });
+        auto newest  = BufferedReverseEnumerator(history);
+
+        static_assert(std::input_iterator<decltype(newest.begin())>);
+        static_assert(std::input_iterator<decltype(input .begin())>);
+
+        auto outer = newest.begin();
+        auto inner = newest.begin();
+        assert(*outer++ == 3 && *outer == 3);
+        ++inner;
+        ++inner;
+        ++inner;
+        assert(*inner == 2 && *outer == 3);
+
+        auto runs = std::vector<std::size_t>();
+        for (auto&& run_ : RunEnumerator(newest))
+        {
+            runs.push_back(run_.count);
+        }
+        assert(runs == std::vector<std::size_t>({ 3, 1, 2 }));
+
+        auto table = std::vector({ 10, 20, 30, 40 });
+        assert(collect(GatherEnumerator(table, newest)) == std::vector({ 40, 40, 40, 30, 20, 20 }));
+
+        auto past  = std::forward_list({ 0, 2, 4 });
+        auto older = BufferedReverseEnumerator(past);
+        assert(collect(MergeEnumerator(std::greater<>(), newest, older)) == std::vector({ 4, 3, 3, 3, 2, 2, 1, 1, 0 }));
+    });
+
+    AKR_TEST(RunEnumerator,
+    {
+        const auto collect = [](auto&& runs_)
+        {
+            auto values_ = std::vector<int>();
+            auto counts_ = std::vector<std::size_t>();
+            for (auto&& [value_, range_, count_] : runs_)
+            {
+                assert(&*range_.begin() == &value_);
+                auto size_ = std::size_t(0);
+                for (auto&& e_ : range_)
+                {
+                    static_cast<void>(e_);
+                    size_++;
+                }
+                assert(size_ == count_);
+                values_.push_back(value_);
+                counts_.push_back(count_);
+            }
+            return std::make_pair(values_, counts_);
+        };
+
+        auto vec = std::vector({ 1, 1, 2, 3, 3, 3, 1 });
+
+        assert(collect(RunEnumerator(vec)).first  == std::vector({ 1, 2, 3, 1 }));
+        assert(collect(RunEnumerator(vec)).second == std::vector<std::size_t>({ 2, 1, 3, 1 }));
+        assert(collect(RunEnumerator(std::list({ 1, 1, 2, 3, 3, 3, 1 }))).second
+               == std::vector<std::size_t>({ 2, 1, 3, 1 }));
+        assert(collect(RunEnumerator(ReverseEnumerator(vec))).first  == std::vector({ 1, 3, 2, 1 }));
+        assert(collect(RunEnumerator(ReverseEnumerator(vec))).second == std::vector<std::size_t>({ 1, 3, 1, 2 }));
+        assert(collect(RunEnumerator(ForwardEnumerator(vec.begin() + 1, vec.end() - 1))).second
+               == std::vector<std::size_t>({ 1, 1, 3 }));
+        assert(collect(RunEnumerator(std::vector<int>())).first.empty());
+
+        const auto byTens = [](int lhs_, int rhs_) { return lhs_ / 10 == rhs_ / 10; };
+        auto tens = std::vector({ 10, 12, 19, 20, 31, 35 });
+        assert(collect(RunEnumerator(tens, byTens)).second == std::vector<std::size_t>({ 3, 1, 2 }));
+        assert(collect(RunEnumerator(ReverseEnumerator(tens), byTens)).second
+               == std::vector<std::size_t>({ 2, 1, 3 }));
+
+        for (auto length = 1; length < 200; length += 7)
+        {
+            auto keys     = std::vector<short>();
+            auto expected = std::vector<std::size_t>();
+            for (auto key = 0; key < 6; key++)
+            {
+                expected.push_back(std::size_t(length + key));
+                keys.insert(keys.end(), std::size_t(length + key), short(key % 2 ? -key : key));
+            }
+
+            auto forward = std::vector<std::size_t>();
+            for (auto&& run_ : RunEnumerator(keys))
+            {
+                forward.push_back(run_.count);
+            }
+            assert(forward == expected);
+
+            auto reverse = std::vector<std::size_t>();
+            for (auto&& run_ : RunEnumerator(ReverseEnumerator(keys)))
+            {
+                reverse.push_back(run_.count);
+            }
+            std::reverse(expected.begin(), expected.end());
+            assert(reverse == expected);
+
+            auto doubles = std::vector<double>(std::size_t(length), 0.5);
+            doubles.push_back(-0.5);
+            auto runs = std::vector<std::size_t>();
+            for (auto&& run_ : RunEnumerator(doubles))
+            {
+                runs.push_back(run_.count);
+            }
+            assert(runs == std::vector<std::size_t>({ std::size_t(length), 1 }));
+        }
+
+        auto rising = std::vector({ 1, 2, 3, 1, 2, 0 });
+        assert(collect(RunEnumerator(rising, std::less_equal<>())).first  == std::vector({ 1, 1, 0 }));
+        assert(collect(RunEnumerator(rising, std::less_equal<>())).second == std::vector<std::size_t>({ 3, 2, 1 }));
+        assert(collect(RunEnumerator(std::list({ 1, 2, 3, 1, 2, 0 }), std::less_equal<>())).second
+               == std::vector<std::size_t>({ 3, 2, 1 }));
+        assert(collect(RunEnumerator(ReverseEnumerator(rising), std::greater_equal<>())).second
+               == std::vector<std::size_t>({ 1, 2, 3 }));
+
+        const auto closeTo = [](int lhs_, int rhs_) { return rhs_ - lhs_ <= 1 && lhs_ - rhs_ <= 1; };
+        assert(collect(RunEnumerator(std::vector({ 1, 2, 3, 4, 9, 10 }), closeTo)).second
+               == std::vector<std::size_t>({ 4, 2 }));
+
+        auto sums = std::vector<int>();
+        for (auto&& run_ : RunEnumerator(tens, byTens))
+        {
+            auto sum_ = 0;
+            for (auto&& e_ : run_.range)
+            {
+                sum_ += e_;
+            }
+            sums.push_back(sum_);
+        }
+        assert(sums == std::vector({ 41, 20, 66 }));
+
+        for (auto&& run_ : RunEnumerator(vec))
+        {
+            run_.value = -run_.value;
+        }
+        assert(vec == std::vector({ -1, 1, -2, -3, 3, 3, -1 }));
+
+        constexpr auto count = []()
+        {
+            int elems_[6];
+            for (auto i_ = 0; i_ < 6; i_++) elems_[i_] = i_ / 4;
+            auto runs_ = std::size_t(0);
+            for (auto&& run_ : RunEnumerator(elems_))
+            {
+                runs_ = runs_ * 10 + run_.count;
+            }
+            return runs_;
+        }();
+        static_assert(count == 42);
+    });
+
+    namespace
+    {
+        auto sumAny(AnyEnumerator<int>& any) -> int
+        {
+            auto sum = 0;
+
+            any.forEach([&](int e) { sum += e; });
+
+            return sum;
+        }
+    }
+
+    AKR_TEST(AnyEnumerator,
+    {
+        auto vec = std::vector({ 1, 2, 3, 4, 5 });
+        auto lst = std::list  ({ 1, 2, 3, 4, 5 });
+
+        int buffer[2];
+
+        {
+            auto any_ = AnyEnumerator(ForwardEnumerator(vec));
+            static_assert(std::is_same_v<decltype(any_), AnyEnumerator<int>>);
+
+            const auto batch_ = any_.read(buffer);
+            assert(batch_.size() == 5 && batch_.data() == vec.data());
+            assert(any_.read(buffer).empty());
+        }
+        {
+            auto any_ = AnyEnumerator<int>(ForwardEnumerator(vec.begin() + 1, vec.end() - 1));
+            assert(sumAny(any_) == 9);
+        }
+        {
+            auto any_ = AnyEnumerator<int>(ReverseEnumerator(vec));
+
+            auto batch_ = any_.read(buffer);
+            assert(batch_.size() == 2 && batch_[0] == 5 && batch_[1] == 4 && batch_.data() == buffer);
+            batch_ = any_.read(buffer);
+            assert(batch_.size() == 2 && batch_[0] == 3 && batch_[1] == 2);
+            batch_ = any_.read(buffer);
+            assert(batch_.size() == 1 && batch_[0] == 1);
+            assert(any_.read(buffer).empty());
+        }
+        {
+            auto any_ = AnyEnumerator<int>(ForwardEnumerator(lst));
+            assert(sumAny(any_) == 15);
+            assert(sumAny(any_) == 0);
+        }
+        {
+            auto any_ = AnyEnumerator<int>(ReverseEnumerator(lst));
+            auto out_ = std::vector<int>();
+            any_.forEach([&](int e_) { out_.push_back(e_); });
+            assert(out_ == std::vector({ 5, 4, 3, 2, 1 }));
+        }
+        {
+            auto any_ = AnyEnumerator<int>();
+            assert(any_.read(buffer).empty());
+            assert(sumAny(any_) == 0);
+        }
+        {
+            auto indices_ = std::vector({ 4, 0 });
+            auto wide_    = (AnyEnumerator<long long, 256>(GatherEnumerator(vec, indices_)));
+            long long wideBuffer_[4];
+            const auto batch_ = wide_.read(wideBuffer_);
+            assert(batch_.size() == 2 && batch_[0] == 5 && batch_[1] == 1);
+        }
+
+        static_assert(sizeof(AnyEnumerator<int>) == 8 * sizeof(void*) + alignof(std::max_align_t));
+        static_assert(!std::is_copy_constructible_v<AnyEnumerator<int>>);
+        auto fe = ForwardEnumerator(vec);
+        static_assert(noexcept(AnyEnumerator<int>(fe)));
+        {
+            auto any_ = AnyEnumerator<int>(fe);
+            assert(any_.read(buffer).data() == vec.data());
+            assert(fe.begin() == vec.begin());
+        }
+        {
+            auto re_  = ReverseEnumerator(vec);
+            auto any_ = AnyEnumerator<int>(re_);
+            assert(sumAny(any_) == 15);
+
+            auto out_ = std::vector<int>();
+            for (auto&& e_ : re_)
+            {
+                out_.push_back(e_);
+            }
+            assert(out_ == std::vector({ 5, 4, 3, 2, 1 }));
+        }
+        {
+            const auto re_  = ReverseEnumerator(lst);
+            auto       any_ = AnyEnumerator<int>(re_);
+            assert(sumAny(any_) == 15);
+        }
+    });
 }
 #endif//D_AKR_TEST
 
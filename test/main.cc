@@ -3,7 +3,10 @@
 
 #include "..\enumerator.hh"
 
+#include <array>
 #include <cstdio>
+#include <forward_list>
+#include <functional>
 #include <vector>
 
 int main()
@@ -33,4 +36,86 @@ int main()
         printf("%d ", e);
     }
     puts("");
+
+    auto runs = std::vector({ std::vector({ 1, 4, 7 }), std::vector({ 2, 5, 8 }), std::vector({ 3, 6, 9 }) });
+
+    for (auto&& e : akr::MergeEnumerator(runs[0], runs[1], runs[2]))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    for (auto&& e : akr::MergeEnumerator(runs.begin(), runs.end()))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    for (auto&& e : akr::MergeEnumerator(std::greater<>(), akr::ReverseEnumerator(runs[0]), akr::ReverseEnumerator(runs[1])))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    auto indices = std::vector({ 4, 0, 2 });
+
+    for (auto&& e : akr::GatherEnumerator(vec, indices))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    for (auto&& e : akr::GatherEnumerator(vec, akr::ReverseEnumerator(indices), 32))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    auto arr = std::to_array({ 1, 2, 3, 4 });
+
+    akr::StaticEnumerator(arr).forEach([](auto&& e, auto i)
+    {
+        printf("%zu:%d ", i(), e);
+    });
+    puts("");
+
+    akr::StaticEnumerator(arr).reverseForEach([](auto&& e)
+    {
+        printf("%d ", e);
+    });
+    puts("");
+
+    auto flist = std::forward_list({ 1, 2, 3, 4, 5 });
+
+    for (auto&& e : akr::BufferedReverseEnumerator(flist))
+    {
+        printf("%d ", e);
+    }
+    puts("");
+
+    auto keys = std::vector({ 1, 1, 2, 3, 3, 3 });
+
+    for (auto&& [value, range, count] : akr::RunEnumerator(keys))
+    {
+        printf("%d:%zu ", value, count);
+    }
+    puts("");
+
+    for (auto&& [value, range, count] : akr::RunEnumerator(akr::ReverseEnumerator(keys)))
+    {
+        printf("%d:%zu ", value, count);
+    }
+    puts("");
+
+    auto any = akr::AnyEnumerator<int>(akr::ReverseEnumerator(vec));
+
+    int buffer[2];
+    for (auto batch = any.read(buffer); !batch.empty(); batch = any.read(buffer))
+    {
+        for (auto&& e : batch)
+        {
+            printf("%d ", e);
+        }
+    }
+    puts("");
 }